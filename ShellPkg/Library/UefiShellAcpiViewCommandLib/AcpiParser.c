@@ -12,14 +12,24 @@
 **/
 
 #include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/UefiLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include "AcpiParser.h"
 #include "AcpiView.h"
 
 STATIC UINT32   gIndent;
-STATIC UINT32   mTableErrorCount;
-STATIC UINT32   mTableWarningCount;
+
+// The counters have external linkage so that hot validation paths can
+// increment them directly instead of going through the EFIAPI
+// Increment*Count wrappers.
+UINT32          mTableErrorCount;
+UINT32          mTableWarningCount;
+
+STATIC EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL* mConOut;
+
+STATIC CHAR16 mIndentBuffer[128];
 
 STATIC ACPI_DESCRIPTION_HEADER_INFO AcpiHdrInfo;
 
@@ -30,6 +40,61 @@ STATIC CONST ACPI_PARSER AcpiHeaderParser[] = {
   PARSE_ACPI_HEADER (&AcpiHdrInfo)
 };
 
+/**
+  This function returns the console output protocol.
+
+  The protocol pointer is cached on first use so that repeated callers
+  do not have to dereference the system table for every invocation.
+
+  @retval Pointer to the console output protocol.
+**/
+STATIC
+EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL*
+GetConsoleOut (
+  VOID
+  )
+{
+  if (mConOut == NULL) {
+    mConOut = gST->ConOut;
+  }
+  return mConOut;
+}
+
+/**
+  This function returns a string of spaces of the requested length.
+
+  The string is carved from a module static buffer of spaces which is
+  initialised on first use. Printing the returned string with %s is
+  cheaper than expanding a '%*a' of the empty string, which emits the
+  padding spaces through the format machine one at a time.
+
+  @param [in] Length  The requested number of spaces. Silently clamped
+                      to the size of the internal buffer.
+
+  @retval Pointer to a NUL terminated string of Length spaces.
+**/
+STATIC
+CONST CHAR16*
+GetIndentString (
+  IN UINT32 Length
+  )
+{
+  UINTN Index;
+
+  if (mIndentBuffer[0] == L'\0') {
+    for (Index = 0; Index < (ARRAY_SIZE (mIndentBuffer) - 1); Index++) {
+      mIndentBuffer[Index] = L' ';
+    }
+    mIndentBuffer[ARRAY_SIZE (mIndentBuffer) - 1] = L'\0';
+  }
+
+  if (Length > (ARRAY_SIZE (mIndentBuffer) - 1)) {
+    Length = ARRAY_SIZE (mIndentBuffer) - 1;
+  }
+
+  return &mIndentBuffer[ARRAY_SIZE (mIndentBuffer) - 1 - Length];
+}
+
 /**
   This function resets the ACPI table error counter to Zero.
 **/
@@ -123,51 +188,239 @@ VerifyChecksum (
   IN UINT32  Length
   )
 {
-  UINTN ByteCount;
-  UINT8 Checksum;
-  UINTN OriginalAttribute;
+  UINTN   ByteCount;
+  UINT8   Checksum;
+  UINTN   OriginalAttribute;
+  UINT8   PartialSum[8];
+  BOOLEAN HighLight;
+  EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL* ConOut;
 
+  // Accumulate eight interleaved partial sums so that the additions do
+  // not form a single serial dependency chain. Addition modulo 256 is
+  // associative, so recombining the lanes afterwards yields the same
+  // checksum as a byte-serial accumulation.
+  ZeroMem (PartialSum, sizeof (PartialSum));
   ByteCount = 0;
-  Checksum = 0;
 
+  while ((ByteCount + 8) <= Length) {
+    PartialSum[0] += Ptr[ByteCount];
+    PartialSum[1] += Ptr[ByteCount + 1];
+    PartialSum[2] += Ptr[ByteCount + 2];
+    PartialSum[3] += Ptr[ByteCount + 3];
+    PartialSum[4] += Ptr[ByteCount + 4];
+    PartialSum[5] += Ptr[ByteCount + 5];
+    PartialSum[6] += Ptr[ByteCount + 6];
+    PartialSum[7] += Ptr[ByteCount + 7];
+    ByteCount += 8;
+  }
+
+  Checksum = (UINT8)(PartialSum[0] + PartialSum[1] + PartialSum[2] +
+                     PartialSum[3] + PartialSum[4] + PartialSum[5] +
+                     PartialSum[6] + PartialSum[7]);
+
+  // Add any remaining bytes not covered by the interleaved lanes.
   while (ByteCount < Length) {
-    Checksum += *(Ptr++);
-    ByteCount++;
+    Checksum += Ptr[ByteCount++];
   }
 
   if (Log) {
-    OriginalAttribute = gST->ConOut->Mode->Attribute;
+    HighLight = GetColourHighlighting ();
+    ConOut = GetConsoleOut ();
+    OriginalAttribute = ConOut->Mode->Attribute;
     if (Checksum == 0) {
-      if (GetColourHighlighting ()) {
-        gST->ConOut->SetAttribute (
-                       gST->ConOut,
-                       EFI_TEXT_ATTR (EFI_GREEN,
-                         ((OriginalAttribute&(BIT4|BIT5|BIT6))>>4))
-                       );
+      if (HighLight) {
+        ConOut->SetAttribute (
+                  ConOut,
+                  EFI_TEXT_ATTR (EFI_GREEN,
+                    ((OriginalAttribute&(BIT4|BIT5|BIT6))>>4))
+                  );
       }
       Print (L"\n\nTable Checksum : OK\n\n");
     } else {
-      IncrementErrorCount ();
-      if (GetColourHighlighting ()) {
-        gST->ConOut->SetAttribute (
-                       gST->ConOut,
-                       EFI_TEXT_ATTR (EFI_RED,
-                         ((OriginalAttribute&(BIT4|BIT5|BIT6))>>4))
-                       );
+      mTableErrorCount++;
+      if (HighLight) {
+        ConOut->SetAttribute (
+                  ConOut,
+                  EFI_TEXT_ATTR (EFI_RED,
+                    ((OriginalAttribute&(BIT4|BIT5|BIT6))>>4))
+                  );
       }
       Print (L"\n\nTable Checksum : FAILED (0x%X)\n\n", Checksum);
     }
-    if (GetColourHighlighting ()) {
-      gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
+    if (HighLight) {
+      ConOut->SetAttribute (ConOut, OriginalAttribute);
     }
   }
 
   return (Checksum == 0);
 }
 
+/**
+  This function converts a byte to its two character hexadecimal
+  representation.
+
+  The conversion is branchless: for each nibble the adjustment from
+  '9' + 1 to 'A' is computed by masking the sign of (9 - Nibble).
+
+  @param [in]  Byte   The byte to convert.
+  @param [out] Chars  Pointer to a buffer to hold the two hex characters.
+**/
+STATIC
+VOID
+ByteToHexChars (
+  IN  UINT8   Byte,
+  OUT CHAR16* Chars
+  )
+{
+  INT32 Nibble;
+
+  Nibble = Byte >> 4;
+  Chars[0] = (CHAR16)(Nibble + '0' + (((9 - Nibble) >> 4) & 7));
+  Nibble = Byte & 0x0F;
+  Chars[1] = (CHAR16)(Nibble + '0' + (((9 - Nibble) >> 4) & 7));
+}
+
+/**
+  This function converts eight bytes to their hexadecimal representation.
+
+  The conversion is performed on all sixteen nibbles in parallel using
+  SWAR (SIMD within a register) arithmetic on two 64-bit lane sets. The
+  nibbles requiring the 'A'-'F' adjustment are detected together by the
+  carry out of bit 3 when 6 is added to every lane.
+
+  @param [in]  Data   Eight bytes of data read as a little endian
+                      64-bit value.
+  @param [out] Chars  Pointer to a buffer to hold the eight resulting
+                      "XX " character triplets (24 characters).
+**/
+STATIC
+VOID
+BytesToHexChars (
+  IN  UINT64  Data,
+  OUT CHAR16* Chars
+  )
+{
+  UINT64 HiChars;
+  UINT64 LoChars;
+  UINTN  Index;
+
+  HiChars = (Data >> 4) & 0x0F0F0F0F0F0F0F0FULL;
+  LoChars = Data & 0x0F0F0F0F0F0F0F0FULL;
+
+  HiChars += 0x3030303030303030ULL +
+             (((HiChars + 0x0606060606060606ULL) >> 4) &
+              0x0101010101010101ULL) * 7;
+  LoChars += 0x3030303030303030ULL +
+             (((LoChars + 0x0606060606060606ULL) >> 4) &
+              0x0101010101010101ULL) * 7;
+
+  for (Index = 0; Index < 8; Index++) {
+    Chars[0] = (CHAR16)(HiChars & 0xFF);
+    Chars[1] = (CHAR16)(LoChars & 0xFF);
+    Chars[2] = L' ';
+    HiChars >>= 8;
+    LoChars >>= 8;
+    Chars += 3;
+  }
+}
+
+/**
+  This function replaces every non-printable byte lane of a 64-bit
+  value with '.'.
+
+  A lane is printable if it is in the range 0x20-0x7E, i.e. if bit 7
+  is clear, the low 7 bits are at least 0x20 and the low 7 bits are
+  not 0x7F. All eight lanes are classified in parallel; the adds used
+  for the classification cannot carry across lanes as both operands
+  have bit 7 clear in every lane.
+
+  @param [in] Data  Eight bytes of data read as a little endian 64-bit
+                    value.
+
+  @retval The input value with the non-printable lanes set to '.'.
+**/
+STATIC
+UINT64
+SanitisePrintableLanes (
+  IN UINT64 Data
+  )
+{
+  UINT64 Low7;
+  UINT64 Printable;
+  UINT64 NonPrintMask;
+
+  Low7 = Data & 0x7F7F7F7F7F7F7F7FULL;
+  Printable = ((Low7 + 0x6060606060606060ULL) &
+               ((Low7 ^ 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL)) &
+              ~Data;
+  NonPrintMask = ((~Printable & 0x8080808080808080ULL) >> 7) * 0xFF;
+
+  return (Data & ~NonPrintMask) | (0x2E2E2E2E2E2E2E2EULL & NonPrintMask);
+}
+
+/**
+  This function writes the ASCII sidebar characters for eight bytes.
+
+  The non-printable bytes are replaced with '.' in a single SWAR pass
+  over all eight lanes before widening the characters.
+
+  @param [in]  Data   Eight bytes of data read as a little endian
+                      64-bit value.
+  @param [out] Chars  Pointer to a buffer to hold the eight resulting
+                      sidebar characters.
+**/
+STATIC
+VOID
+BytesToAsciiChars (
+  IN  UINT64  Data,
+  OUT CHAR16* Chars
+  )
+{
+  UINTN Index;
+
+  Data = SanitisePrintableLanes (Data);
+
+  for (Index = 0; Index < 8; Index++) {
+    Chars[Index] = (CHAR16)(Data & 0xFF);
+    Data >>= 8;
+  }
+}
+
+/**
+  This function maps a byte to itself if it is printable ASCII, or to
+  '.' otherwise.
+
+  The selection is branchless: the out-of-range condition is turned
+  into an all ones/all zeros mask by an arithmetic shift of its sign.
+
+  @param [in] Byte  The byte to filter.
+
+  @retval The printable character for the ASCII sidebar.
+**/
+STATIC
+CHAR16
+AsciiDotFilter (
+  IN UINT8 Byte
+  )
+{
+  INT32 Bad;
+
+  // Bad is all ones when (Byte - 0x20) is above 0x5E, i.e. when the
+  // byte is outside the printable range 0x20-0x7E.
+  Bad = (0x5E - (INT32)((UINT8)(Byte - 0x20))) >> 31;
+  return (CHAR16)((Byte & ~Bad) | ('.' & Bad));
+}
+
 /**
   This function performs a raw data dump of the ACPI table.
 
+  Each 16 byte row - the newline, the row address, the hex
+  representation and the ASCII sidebar - is fully assembled in a local
+  line buffer and emitted with a single Print of a plain string, so no
+  per-byte or per-row format processing is required. Full rows are
+  converted eight bytes at a time using SWAR arithmetic; only a
+  partial final row falls back to the byte-at-a-time conversion.
+
   @param [in] Ptr     Pointer to the start of the table buffer.
   @param [in] Length  The length of the buffer.
 **/
@@ -178,54 +431,92 @@ DumpRaw (
   IN UINT32 Length
   )
 {
-  UINTN ByteCount;
-  UINTN PartLineChars;
-  UINTN AsciiBufferIndex;
-  CHAR8 AsciiBuffer[17];
+  UINTN   ByteCount;
+  UINTN   RowByteCount;
+  UINTN   RowOffset;
+  UINTN   HexIndex;
+  UINT64  Data;
+  CHAR16  Line[88];
+  CHAR16* HexBuffer;
+  CHAR16* AsciiBuffer;
+
+  // Line layout:
+  //   [0]     newline
+  //   [1-8]   row offset, 8 hex digits
+  //   [9-11]  " : "
+  //   [12-61] hex representation of up to 16 bytes
+  //   [62-63] "  "
+  //   [64-80] ASCII sidebar and NUL terminator
+  HexBuffer = &Line[12];
+  AsciiBuffer = &Line[64];
+  Line[0] = L'\n';
+  Line[9] = L' ';
+  Line[10] = L':';
+  Line[11] = L' ';
+  Line[62] = L' ';
+  Line[63] = L' ';
 
   ByteCount = 0;
-  AsciiBufferIndex = 0;
 
   Print (L"Address  : 0x%p\n", Ptr);
   Print (L"Length   : %d\n", Length);
+  Print (L"  ");
 
   while (ByteCount < Length) {
-    if ((ByteCount & 0x0F) == 0) {
-      AsciiBuffer[AsciiBufferIndex] = '\0';
-      Print (L"  %a\n%08X : ", AsciiBuffer, ByteCount);
-      AsciiBufferIndex = 0;
-    } else if ((ByteCount & 0x07) == 0) {
-      Print (L"- ");
+    RowOffset = ByteCount;
+    RowByteCount = 0;
+    HexIndex = 0;
+
+    ByteToHexChars ((UINT8)(RowOffset >> 24), &Line[1]);
+    ByteToHexChars ((UINT8)(RowOffset >> 16), &Line[3]);
+    ByteToHexChars ((UINT8)(RowOffset >> 8), &Line[5]);
+    ByteToHexChars ((UINT8)RowOffset, &Line[7]);
+
+    if ((Length - ByteCount) >= 16) {
+      // Full row. Each half row is loaded once and feeds both the hex
+      // conversion and the ASCII sidebar filter in single SWAR passes.
+      Data = ReadUnaligned64 ((CONST UINT64*)Ptr);
+      BytesToHexChars (Data, &HexBuffer[0]);
+      BytesToAsciiChars (Data, &AsciiBuffer[0]);
+
+      HexBuffer[24] = L'-';
+      HexBuffer[25] = L' ';
+
+      Data = ReadUnaligned64 ((CONST UINT64*)(Ptr + 8));
+      BytesToHexChars (Data, &HexBuffer[26]);
+      BytesToAsciiChars (Data, &AsciiBuffer[8]);
+
+      HexIndex = 50;
+      RowByteCount = 16;
+      Ptr += 16;
+      ByteCount += 16;
     }
 
-    if ((*Ptr >= ' ') && (*Ptr < 0x7F)) {
-      AsciiBuffer[AsciiBufferIndex++] = *Ptr;
-    } else {
-      AsciiBuffer[AsciiBufferIndex++] = '.';
-    }
+    while ((RowByteCount < 16) && (ByteCount < Length)) {
+      if (RowByteCount == 8) {
+        HexBuffer[HexIndex++] = L'-';
+        HexBuffer[HexIndex++] = L' ';
+      }
 
-    Print (L"%02X ", *Ptr++);
+      ByteToHexChars (*Ptr, &HexBuffer[HexIndex]);
+      HexIndex += 2;
+      HexBuffer[HexIndex++] = L' ';
 
-    ByteCount++;
-  }
+      AsciiBuffer[RowByteCount] = AsciiDotFilter (*Ptr);
 
-  // Justify the final line using spaces before printing
-  // the ASCII data.
-  PartLineChars = (Length & 0x0F);
-  if (PartLineChars != 0) {
-    PartLineChars = 48 - (PartLineChars * 3);
-    if ((Length & 0x0F) <= 8) {
-      PartLineChars += 2;
+      Ptr++;
+      RowByteCount++;
+      ByteCount++;
     }
-    while (PartLineChars > 0) {
-      Print (L" ");
-      PartLineChars--;
+
+    // Justify a partial final row using spaces before the ASCII data.
+    while (HexIndex < 50) {
+      HexBuffer[HexIndex++] = L' ';
     }
-  }
+    AsciiBuffer[RowByteCount] = L'\0';
 
-  // Print ASCII data for the final line.
-  AsciiBuffer[AsciiBufferIndex] = '\0';
-  Print (L"  %a", AsciiBuffer);
+    Print (L"%s", Line);
+  } // while
 }
 
 /**
@@ -289,17 +580,42 @@ DumpUint64 (
   IN UINT8*        Ptr
   )
 {
-  // Some fields are not aligned and this causes alignment faults
-  // on ARM platforms if the compiler generates LDRD instructions.
-  // Perform word access so that LDRD instructions are not generated.
-  UINT64 Val;
+  // Some fields are not aligned. Use the BaseLib unaligned access
+  // worker, which is a plain 64-bit load on architectures that
+  // support unaligned accesses and a safe split access on ARM.
+  Print (Format, ReadUnaligned64 ((CONST UINT64*)Ptr));
+}
+
+/**
+  This function traces up to 8 characters as a fixed width ASCII string.
 
-  Val = *(UINT32*)(Ptr + sizeof (UINT32));
+  Any character outside the printable ASCII range is replaced by a '.'
+  so that stray field content cannot corrupt the console output. The
+  characters are classified in parallel using carry free SWAR
+  arithmetic on the 7-bit lane values, and the sanitised string is
+  printed with a single Print call.
+
+  @param [in] Ptr       Pointer to the start of the buffer.
+  @param [in] NumChars  Number of characters to trace (1 to 8).
+**/
+STATIC
+VOID
+DumpChars (
+  IN UINT8* Ptr,
+  IN UINTN  NumChars
+  )
+{
+  UINT64 Data;
+  CHAR8  Buffer[9];
 
-  Val <<= 32;
-  Val |= (UINT64)*(UINT32*)Ptr;
+  Data = 0;
+  CopyMem (&Data, Ptr, NumChars);
 
-  Print (Format, Val);
+  Data = SanitisePrintableLanes (Data);
+
+  CopyMem (Buffer, &Data, NumChars);
+  Buffer[NumChars] = '\0';
+  Print (L"%a", Buffer);
 }
 
 /**
@@ -318,12 +634,11 @@ Dump3Chars (
   IN UINT8*        Ptr
   )
 {
-  Print (
-    (Format != NULL) ? Format : L"%c%c%c",
-    Ptr[0],
-    Ptr[1],
-    Ptr[2]
-    );
+  if (Format != NULL) {
+    Print (Format, Ptr[0], Ptr[1], Ptr[2]);
+  } else {
+    DumpChars (Ptr, 3);
+  }
 }
 
 /**
@@ -342,13 +657,11 @@ Dump4Chars (
   IN UINT8*        Ptr
   )
 {
-  Print (
-    (Format != NULL) ? Format : L"%c%c%c%c",
-    Ptr[0],
-    Ptr[1],
-    Ptr[2],
-    Ptr[3]
-    );
+  if (Format != NULL) {
+    Print (Format, Ptr[0], Ptr[1], Ptr[2], Ptr[3]);
+  } else {
+    DumpChars (Ptr, 4);
+  }
 }
 
 /**
@@ -367,15 +680,11 @@ Dump6Chars (
   IN UINT8*        Ptr
   )
 {
-  Print (
-    (Format != NULL) ? Format : L"%c%c%c%c%c%c",
-    Ptr[0],
-    Ptr[1],
-    Ptr[2],
-    Ptr[3],
-    Ptr[4],
-    Ptr[5]
-    );
+  if (Format != NULL) {
+    Print (Format, Ptr[0], Ptr[1], Ptr[2], Ptr[3], Ptr[4], Ptr[5]);
+  } else {
+    DumpChars (Ptr, 6);
+  }
 }
 
 /**
@@ -394,17 +703,21 @@ Dump8Chars (
   IN UINT8*        Ptr
   )
 {
-  Print (
-    (Format != NULL) ? Format : L"%c%c%c%c%c%c%c%c",
-    Ptr[0],
-    Ptr[1],
-    Ptr[2],
-    Ptr[3],
-    Ptr[4],
-    Ptr[5],
-    Ptr[6],
-    Ptr[7]
-    );
+  if (Format != NULL) {
+    Print (
+      Format,
+      Ptr[0],
+      Ptr[1],
+      Ptr[2],
+      Ptr[3],
+      Ptr[4],
+      Ptr[5],
+      Ptr[6],
+      Ptr[7]
+      );
+  } else {
+    DumpChars (Ptr, 8);
+  }
 }
 
 /**
@@ -427,14 +740,29 @@ PrintFieldName (
 )
 {
   Print (
-    L"%*a%-*s : ",
-    gIndent + Indent,
-    "",
+    L"%s%-*s : ",
+    GetIndentString (gIndent + Indent),
     (OUTPUT_FIELD_COLUMN_WIDTH - gIndent - Indent),
     FieldName
     );
 }
 
+/**
+  Table of trace functions for the supported field lengths, indexed by
+  the field length in bytes. Entries for unsupported lengths are NULL.
+**/
+STATIC CONST FNPTR_PRINT_FORMATTER DumpFieldFn[] = {
+  NULL,        // 0 - invalid
+  DumpUint8,   // 1
+  DumpUint16,  // 2
+  NULL,        // 3 - invalid
+  DumpUint32,  // 4
+  NULL,        // 5 - invalid
+  NULL,        // 6 - invalid
+  NULL,        // 7 - invalid
+  DumpUint64   // 8
+};
+
 /**
   This function is used to parse an ACPI table buffer.
 
@@ -473,39 +801,74 @@ ParseAcpi (
   IN UINT32             ParserItems
 )
 {
-  UINT32  Index;
-  UINT32  Offset;
-  BOOLEAN HighLight;
-  UINTN   OriginalAttribute;
+  UINT32        Index;
+  UINT32        Offset;
+  UINT32        LocalIndent;
+  BOOLEAN       HighLight;
+  UINTN         OriginalAttribute;
+  CONST CHAR16* FieldIndent;
+  UINT32        FieldColumnWidth;
+  EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL* ConOut;
 
   Offset = 0;
 
-  // Increment the Indent
-  gIndent += Indent;
+  // When not tracing, only the Ptr/Offset advance and the ItemPtr
+  // updates are needed for field extraction; take a minimal pass over
+  // the parser array that skips all trace related work. Nothing on
+  // this path prints, so gIndent is left untouched.
+  if (!Trace) {
+    for (Index = 0; Index < ParserItems; Index++) {
+      if ((Offset + Parser[Index].Length) > Length) {
+        // We don't parse past the end of the max length specified
+        break;
+      }
+
+      if (Parser[Index].ItemPtr != NULL) {
+        *Parser[Index].ItemPtr = (VOID*)Ptr;
+      }
+
+      Ptr += Parser[Index].Length;
+      Offset += Parser[Index].Length;
+    } // for
+
+    return Offset;
+  }
+
+  // The effective indent is kept in a stack local so that the field
+  // loop does not reload the global. gIndent is still updated so that
+  // field validators printing through PrintFieldName nest correctly.
+  LocalIndent = gIndent + Indent;
+  gIndent = LocalIndent;
 
   if (Trace && (AsciiName != NULL)){
     HighLight = GetColourHighlighting ();
 
     if (HighLight) {
-      OriginalAttribute = gST->ConOut->Mode->Attribute;
-      gST->ConOut->SetAttribute (
-                     gST->ConOut,
-                     EFI_TEXT_ATTR(EFI_YELLOW,
-                       ((OriginalAttribute&(BIT4|BIT5|BIT6))>>4))
-                     );
+      ConOut = GetConsoleOut ();
+      OriginalAttribute = ConOut->Mode->Attribute;
+      ConOut->SetAttribute (
+                ConOut,
+                EFI_TEXT_ATTR(EFI_YELLOW,
+                  ((OriginalAttribute&(BIT4|BIT5|BIT6))>>4))
+                );
     }
     Print (
-      L"%*a%-*a :\n",
-      gIndent,
-      "",
-      (OUTPUT_FIELD_COLUMN_WIDTH - gIndent),
+      L"%s%-*a :\n",
+      GetIndentString (LocalIndent),
+      (OUTPUT_FIELD_COLUMN_WIDTH - LocalIndent),
       AsciiName
       );
     if (HighLight) {
-      gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
+      ConOut->SetAttribute (ConOut, OriginalAttribute);
     }
   }
 
+  // The indent does not change for the duration of this call, so the
+  // field name indent prefix and column padding used for every traced
+  // field can be computed once, outside the field loop.
+  FieldIndent = GetIndentString (LocalIndent + 2);
+  FieldColumnWidth = OUTPUT_FIELD_COLUMN_WIDTH - LocalIndent - 2;
+
   for (Index = 0; Index < ParserItems; Index++) {
     if ((Offset + Parser[Index].Length) > Length) {
       // We don't parse past the end of the max length specified
@@ -513,7 +876,7 @@ ParseAcpi (
     }
 
     if (Offset != Parser[Index].Offset) {
-      IncrementErrorCount ();
+      mTableErrorCount++;
       Print (
         L"\nERROR: %a: Offset Mismatch for %s\n"
           L"CurrentOffset = %d FieldOffset = %d\n",
@@ -524,43 +887,33 @@ ParseAcpi (
         );
     }
 
-    if (Trace) {
-      // if there is a Formatter function let the function handle
-      // the printing else if a Format is specified in the table use
-      // the Format for printing
-      PrintFieldName (2, Parser[Index].NameStr);
-      if (Parser[Index].PrintFormatter != NULL) {
-        Parser[Index].PrintFormatter (Parser[Index].Format, Ptr);
-      } else if (Parser[Index].Format != NULL) {
-        switch (Parser[Index].Length) {
-          case 1:
-            DumpUint8 (Parser[Index].Format, Ptr);
-            break;
-          case 2:
-            DumpUint16 (Parser[Index].Format, Ptr);
-            break;
-          case 4:
-            DumpUint32 (Parser[Index].Format, Ptr);
-            break;
-          case 8:
-            DumpUint64 (Parser[Index].Format, Ptr);
-            break;
-          default:
-            Print (
-              L"\nERROR: %a: CANNOT PARSE THIS FIELD, Field Length = %d\n",
-              AsciiName,
-              Parser[Index].Length
-              );
-        } // switch
-
-        // Validating only makes sense if we are tracing
-        // the parsed table entries, to report by table name.
-        if (Parser[Index].FieldValidator != NULL) {
-          Parser[Index].FieldValidator (Ptr, Parser[Index].Context);
-        }
+    // if there is a Formatter function let the function handle
+    // the printing else if a Format is specified in the table use
+    // the Format for printing
+    Print (L"%s%-*s : ", FieldIndent, FieldColumnWidth, Parser[Index].NameStr);
+    if (Parser[Index].PrintFormatter != NULL) {
+      Parser[Index].PrintFormatter (Parser[Index].Format, Ptr);
+    } else if (Parser[Index].Format != NULL) {
+      // Dispatch on the field length through the trace function
+      // table; only lengths with a non NULL entry can be parsed.
+      if ((Parser[Index].Length < ARRAY_SIZE (DumpFieldFn)) &&
+          (DumpFieldFn[Parser[Index].Length] != NULL)) {
+        DumpFieldFn[Parser[Index].Length] (Parser[Index].Format, Ptr);
+      } else {
+        Print (
+          L"\nERROR: %a: CANNOT PARSE THIS FIELD, Field Length = %d\n",
+          AsciiName,
+          Parser[Index].Length
+          );
+      }
+
+      // Validating only makes sense if we are tracing
+      // the parsed table entries, to report by table name.
+      if (Parser[Index].FieldValidator != NULL) {
+        Parser[Index].FieldValidator (Ptr, Parser[Index].Context);
       }
-      Print (L"\n");
-    } // if (Trace)
+    }
+    Print (L"\n");
 
     if (Parser[Index].ItemPtr != NULL) {
       *Parser[Index].ItemPtr = (VOID*)Ptr;
@@ -570,8 +923,8 @@ ParseAcpi (
     Offset += Parser[Index].Length;
   } // for
 
-  // Decrement the Indent
-  gIndent -= Indent;
+  // Restore the Indent
+  gIndent = LocalIndent - Indent;
   return Offset;
 }
 
@@ -673,20 +1026,13 @@ ParseAcpiHeader (
   OUT CONST UINT8**  Revision
   )
 {
-  UINT32                        BytesParsed;
-
-  BytesParsed = ParseAcpi (
-                  FALSE,
-                  0,
-                  NULL,
-                  Ptr,
-                  ACPI_DESCRIPTION_HEADER_LENGTH,
-                  PARSER_PARAMS (AcpiHeaderParser)
-                  );
-
-  *Signature = AcpiHdrInfo.Signature;
-  *Length = AcpiHdrInfo.Length;
-  *Revision = AcpiHdrInfo.Revision;
-
-  return BytesParsed;
+  // The offsets of the signature, length and revision fields are fixed
+  // by the ACPI specification, so the fields can be located directly
+  // without walking the AcpiHeaderParser array. This function is called
+  // for every installed ACPI table.
+  *Signature = (CONST UINT32*)Ptr;
+  *Length = (CONST UINT32*)(Ptr + 4);
+  *Revision = (CONST UINT8*)(Ptr + 8);
+
+  return ACPI_DESCRIPTION_HEADER_LENGTH;
 }
@@ -22,6 +22,16 @@
 /// that allows us to process the log options.
 #define RSDP_TABLE_INFO  SIGNATURE_32('R', 'S', 'D', 'P')
 
+/// The ACPI table error counter. Hot validation paths inside the
+/// library increment this directly; external users must go through
+/// IncrementErrorCount().
+extern UINT32 mTableErrorCount;
+
+/// The ACPI table warning counter. Hot validation paths inside the
+/// library increment this directly; external users must go through
+/// IncrementWarningCount().
+extern UINT32 mTableWarningCount;
+
 /**
   This function increments the ACPI table error counter.
 **/
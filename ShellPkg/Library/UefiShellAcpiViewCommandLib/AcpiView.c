@@ -328,6 +328,7 @@ AcpiView (
   UINT8                    RsdpRevision;
   PARSE_ACPI_TABLE_PROC    RsdpParserProc;
   BOOLEAN                  Trace;
+  BOOLEAN                  HighLight;
 
   // Search the table for an entry that matches the ACPI Table Guid
   FoundAcpiTable = FALSE;
@@ -389,10 +390,11 @@ AcpiView (
       Print (L"\nRequested ACPI Table not found.\n");
     } else if (ReportDumpBinFile != ReportOption) {
       OriginalAttribute = gST->ConOut->Mode->Attribute;
+      HighLight = GetColourHighlighting ();
 
       Print (L"\nTable Statistics:\n");
 
-      if (GetColourHighlighting ()) {
+      if (HighLight) {
         PrintAttribute = (GetErrorCount () > 0) ?
                             EFI_TEXT_ATTR (
                               EFI_RED,
@@ -403,7 +405,7 @@ AcpiView (
       }
       Print (L"\t%d Error(s)\n", GetErrorCount ());
 
-      if (GetColourHighlighting ()) {
+      if (HighLight) {
         PrintAttribute = (GetWarningCount () > 0) ?
                             EFI_TEXT_ATTR (
                               EFI_RED,
@@ -415,7 +417,7 @@ AcpiView (
       }
       Print (L"\t%d Warning(s)\n", GetWarningCount ());
 
-      if (GetColourHighlighting ()) {
+      if (HighLight) {
         gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
       }
     }
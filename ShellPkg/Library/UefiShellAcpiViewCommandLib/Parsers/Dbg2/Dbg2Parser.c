@@ -117,7 +117,7 @@ ValidateNameSpaceStrLen (
   NameSpaceStrLen = *(UINT16*)Ptr;
 
   if (NameSpaceStrLen < 2) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: NamespaceString Length = %d. If no Namespace device exists,\n"
        L"    then NamespaceString[] must contain a period '.'",
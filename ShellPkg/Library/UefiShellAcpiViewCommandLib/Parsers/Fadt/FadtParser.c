@@ -165,7 +165,7 @@ ValidateFirmwareCtrl (
 {
 #if defined (MDE_CPU_ARM) || defined (MDE_CPU_AARCH64)
   if (*(UINT32*)Ptr != 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: Firmware Control must be zero for ARM platforms."
     );
@@ -190,7 +190,7 @@ ValidateXFirmwareCtrl (
 {
 #if defined (MDE_CPU_ARM) || defined (MDE_CPU_AARCH64)
   if (*(UINT64*)Ptr != 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: X Firmware Control must be zero for ARM platforms."
     );
@@ -215,7 +215,7 @@ ValidateFlags (
 {
 #if defined (MDE_CPU_ARM) || defined (MDE_CPU_AARCH64)
   if (((*(UINT32*)Ptr) & HW_REDUCED_ACPI) == 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: HW_REDUCED_ACPI flag must be set for ARM platforms."
     );
@@ -260,7 +260,7 @@ ParseAcpiFadt (
     Print (L"%d.%d\n",  *AcpiHdrInfo.Revision, *FadtMinorRevision);
 
     if (*GetAcpiXsdtHeaderInfo ()->OemTableId != *AcpiHdrInfo.OemTableId) {
-      IncrementErrorCount ();
+      mTableErrorCount++;
       Print (L"ERROR: OEM Table Id does not match with RSDT/XSDT.\n");
     }
   }
@@ -278,7 +278,7 @@ ParseAcpiFadt (
       // The DSDT Table is mandatory for ARM systems
       // as the CPU information MUST be presented in
       // the DSDT.
-      IncrementErrorCount ();
+      mTableErrorCount++;
       Print (L"ERROR: Both X_DSDT and DSDT are NULL.\n");
     }
 #endif
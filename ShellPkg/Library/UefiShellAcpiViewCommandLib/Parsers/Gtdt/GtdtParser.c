@@ -143,7 +143,7 @@ ValidateGtBlockTimerCount (
   BlockTimerCount = *(UINT32*)Ptr;
 
   if (BlockTimerCount > 8) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: Timer Count = %d. Max Timer Count is 8.",
       BlockTimerCount
@@ -198,7 +198,7 @@ DumpGTBlock (
     }
 
     if (Length != 0) {
-      IncrementErrorCount ();
+      mTableErrorCount++;
       Print (
         L"ERROR:GT Block Timer length mismatch. Unparsed %d bytes.\n",
         Length
@@ -292,7 +292,7 @@ ParseAcpiGtdt (
           DumpWatchdogTimer (TimerPtr, *PlatformTimerLength);
           break;
         default:
-          IncrementErrorCount ();
+          mTableErrorCount++;
           Print (
             L"ERROR: INVALID Platform Timer Type = %d\n",
             *PlatformTimerType
@@ -246,7 +246,7 @@ ValidateItsIdMappingCount (
   )
 {
   if (*(UINT32*)Ptr != 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (L"\nERROR: IORT ID Mapping count must be zero.");
   }
 }
@@ -267,7 +267,7 @@ ValidateItsIdArrayReference (
   )
 {
   if (*(UINT32*)Ptr != 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (L"\nERROR: IORT ID Mapping offset must be zero.");
   }
 }
@@ -589,7 +589,7 @@ DumpIortNodePmcg (
   }
 
   if (*IortIdMappingCount > 1) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"ERROR: ID mapping must not be greater than 1. Id Mapping Count =%d\n",
       *IortIdMappingCount
@@ -656,7 +656,7 @@ ParseAcpiIort (
       PARSER_PARAMS (IortNodeHeaderParser)
       );
     if (*IortNodeLength == 0) {
-      IncrementErrorCount ();
+      mTableErrorCount++;
       Print (L"ERROR: Parser error. Invalid table data.\n");
       return;
     }
@@ -713,7 +713,7 @@ ParseAcpiIort (
         break;
 
       default:
-        IncrementErrorCount ();
+        mTableErrorCount++;
         Print (L"ERROR: Unsupported IORT Node type = %d\n", *IortNodeType);
     } // switch
 
@@ -15,13 +15,17 @@
 **/
 
 #include <IndustryStandard/Acpi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/PrintLib.h>
+#include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiLib.h>
 #include "AcpiParser.h"
 #include "AcpiTableParser.h"
+#include "AcpiView.h"
 
 // Local Variables
-STATIC CONST UINT8* MadtInterruptControllerType;
-STATIC CONST UINT8* MadtInterruptControllerLength;
 STATIC ACPI_DESCRIPTION_HEADER_INFO AcpiHdrInfo;
 
 /**
@@ -40,87 +44,112 @@ ValidateGICDSystemVectorBase (
   );
 
 /**
-  An ACPI_PARSER array describing the GICC Interrupt Controller Structure.
+  An ACPI_PARSER array describing the common Type/Length/Reserved header
+  that starts every Interrupt Controller Structure. The structure body
+  parsers below describe only the fields after this header, with their
+  offsets rebased to the end of the header, and are applied in a second
+  ParseAcpi call.
 **/
-STATIC CONST ACPI_PARSER GicCParser[] = {
+STATIC CONST ACPI_PARSER MadtStructureHeaderParser[] = {
   {L"Type", 1, 0, L"0x%x", NULL, NULL, NULL, NULL},
   {L"Length", 1, 1, L"%d", NULL, NULL, NULL, NULL},
-  {L"Reserved", 2, 2, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"Reserved", 2, 2, L"0x%x", NULL, NULL, NULL, NULL}
+};
 
-  {L"CPU Interface Number", 4, 4, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"ACPI Processor UID", 4, 8, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Flags", 4, 12, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Parking Protocol Version", 4, 16, L"0x%x", NULL, NULL, NULL, NULL},
-
-  {L"Performance Interrupt GSIV", 4, 20, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Parked Address", 8, 24, L"0x%lx", NULL, NULL, NULL, NULL},
-  {L"Physical Base Address", 8, 32, L"0x%lx", NULL, NULL, NULL, NULL},
-  {L"GICV", 8, 40, L"0x%lx", NULL, NULL, NULL, NULL},
-  {L"GICH", 8, 48, L"0x%lx", NULL, NULL, NULL, NULL},
-  {L"VGIC Maintenance interrupt", 4, 56, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"GICR Base Address", 8, 60, L"0x%lx", NULL, NULL, NULL, NULL},
-  {L"MPIDR", 8, 68, L"0x%lx", NULL, NULL, NULL, NULL},
-  {L"Processor Power Efficiency Class", 1, 76, L"0x%x", NULL, NULL, NULL,
+/**
+  An ACPI_PARSER array describing the GICC Interrupt Controller
+  Structure body.
+**/
+STATIC CONST ACPI_PARSER GicCParser[] = {
+  {L"CPU Interface Number", 4, 0, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"ACPI Processor UID", 4, 4, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"Flags", 4, 8, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"Parking Protocol Version", 4, 12, L"0x%x", NULL, NULL, NULL, NULL},
+
+  {L"Performance Interrupt GSIV", 4, 16, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"Parked Address", 8, 20, L"0x%lx", NULL, NULL, NULL, NULL},
+  {L"Physical Base Address", 8, 28, L"0x%lx", NULL, NULL, NULL, NULL},
+  {L"GICV", 8, 36, L"0x%lx", NULL, NULL, NULL, NULL},
+  {L"GICH", 8, 44, L"0x%lx", NULL, NULL, NULL, NULL},
+  {L"VGIC Maintenance interrupt", 4, 52, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"GICR Base Address", 8, 56, L"0x%lx", NULL, NULL, NULL, NULL},
+  {L"MPIDR", 8, 64, L"0x%lx", NULL, NULL, NULL, NULL},
+  {L"Processor Power Efficiency Class", 1, 72, L"0x%x", NULL, NULL, NULL,
    NULL},
-  {L"Reserved", 3, 77, L"%x %x %x", Dump3Chars, NULL, NULL, NULL}
+  {L"Reserved", 3, 73, L"%x %x %x", Dump3Chars, NULL, NULL, NULL}
 };
 
 /**
-  An ACPI_PARSER array describing the GICD Interrupt Controller Structure.
+  An ACPI_PARSER array describing the GICD Interrupt Controller
+  Structure body.
 **/
 STATIC CONST ACPI_PARSER GicDParser[] = {
-  {L"Type", 1, 0, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Length", 1, 1, L"%d", NULL, NULL, NULL, NULL},
-  {L"Reserved", 2, 2, L"0x%x", NULL, NULL, NULL, NULL},
-
-  {L"GIC ID", 4, 4, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Physical Base Address", 8, 8, L"0x%lx", NULL, NULL, NULL, NULL},
-  {L"System Vector Base", 4, 16, L"0x%x", NULL, NULL,
+  {L"GIC ID", 4, 0, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"Physical Base Address", 8, 4, L"0x%lx", NULL, NULL, NULL, NULL},
+  {L"System Vector Base", 4, 12, L"0x%x", NULL, NULL,
     ValidateGICDSystemVectorBase, NULL},
-  {L"GIC Version", 1, 20, L"%d", NULL, NULL, NULL, NULL},
-  {L"Reserved", 3, 21, L"%x %x %x", Dump3Chars, NULL, NULL, NULL}
+  {L"GIC Version", 1, 16, L"%d", NULL, NULL, NULL, NULL},
+  {L"Reserved", 3, 17, L"%x %x %x", Dump3Chars, NULL, NULL, NULL}
 };
 
 /**
-  An ACPI_PARSER array describing the MSI Frame Interrupt Controller Structure.
+  An ACPI_PARSER array describing the MSI Frame Interrupt Controller
+  Structure body.
 **/
 STATIC CONST ACPI_PARSER GicMSIFrameParser[] = {
-  {L"Type", 1, 0, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Length", 1, 1, L"%d", NULL, NULL, NULL, NULL},
-  {L"Reserved", 2, 2, L"0x%x", NULL, NULL, NULL, NULL},
-
-  {L"MSI Frame ID", 4, 4, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Physical Base Address", 8, 8, L"0x%lx", NULL, NULL, NULL, NULL},
-  {L"Flags", 4, 16, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"MSI Frame ID", 4, 0, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"Physical Base Address", 8, 4, L"0x%lx", NULL, NULL, NULL, NULL},
+  {L"Flags", 4, 12, L"0x%x", NULL, NULL, NULL, NULL},
 
-  {L"SPI Count", 2, 20, L"%d", NULL, NULL, NULL, NULL},
-  {L"SPI Base", 2, 22, L"0x%x", NULL, NULL, NULL, NULL}
+  {L"SPI Count", 2, 16, L"%d", NULL, NULL, NULL, NULL},
+  {L"SPI Base", 2, 18, L"0x%x", NULL, NULL, NULL, NULL}
 };
 
 /**
-  An ACPI_PARSER array describing the GICR Interrupt Controller Structure.
+  An ACPI_PARSER array describing the GICR Interrupt Controller
+  Structure body.
 **/
 STATIC CONST ACPI_PARSER GicRParser[] = {
-  {L"Type", 1, 0, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Length", 1, 1, L"%d", NULL, NULL, NULL, NULL},
-  {L"Reserved", 2, 2, L"0x%x", NULL, NULL, NULL, NULL},
-
-  {L"Discovery Range Base Address", 8, 4, L"0x%lx", NULL, NULL, NULL,
+  {L"Discovery Range Base Address", 8, 0, L"0x%lx", NULL, NULL, NULL,
    NULL},
-  {L"Discovery Range Length", 4, 12, L"0x%x", NULL, NULL, NULL, NULL}
+  {L"Discovery Range Length", 4, 8, L"0x%x", NULL, NULL, NULL, NULL}
 };
 
 /**
-  An ACPI_PARSER array describing the GIC ITS Interrupt Controller Structure.
+  An ACPI_PARSER array describing the GIC ITS Interrupt Controller
+  Structure body.
 **/
 STATIC CONST ACPI_PARSER GicITSParser[] = {
-  {L"Type", 1, 0, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Length", 1, 1, L"%d", NULL, NULL, NULL, NULL},
-  {L"Reserved", 2, 2, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"GIC ITS ID", 4, 0, L"0x%x", NULL, NULL, NULL, NULL},
+  {L"Physical Base Address", 8, 4, L"0x%lx", NULL, NULL, NULL, NULL},
+  {L"Reserved", 4, 12, L"0x%x", NULL, NULL, NULL, NULL}
+};
+
+/**
+  A structure holding the dispatch information for an Interrupt
+  Controller Structure type.
+**/
+typedef struct MadtControllerInfo {
+  /// Interrupt Controller Structure name
+  CONST CHAR8*       Name;
+  /// ACPI_PARSER array describing the structure
+  CONST ACPI_PARSER* Parser;
+  /// Number of items in the Parser array
+  UINT32             Elements;
+} MADT_CONTROLLER_INFO;
 
-  {L"GIC ITS ID", 4, 4, L"0x%x", NULL, NULL, NULL, NULL},
-  {L"Physical Base Address", 8, 8, L"0x%lx", NULL, NULL, NULL, NULL},
-  {L"Reserved", 4, 16, L"0x%x", NULL, NULL, NULL, NULL}
+/**
+  A dispatch table for the GIC Interrupt Controller Structures, indexed
+  by (Type - EFI_ACPI_6_2_GIC). Types outside the table are reported as
+  unknown.
+**/
+STATIC CONST MADT_CONTROLLER_INFO MadtControllerInfo[] = {
+  {"GICC", GicCParser, ARRAY_SIZE (GicCParser)},                // 0xB
+  {"GICD", GicDParser, ARRAY_SIZE (GicDParser)},                // 0xC
+  {"GIC MSI Frame", GicMSIFrameParser,
+   ARRAY_SIZE (GicMSIFrameParser)},                             // 0xD
+  {"GICR", GicRParser, ARRAY_SIZE (GicRParser)},                // 0xE
+  {"GIC ITS", GicITSParser, ARRAY_SIZE (GicITSParser)}          // 0xF
 };
 
 /**
@@ -133,16 +162,6 @@ STATIC CONST ACPI_PARSER MadtParser[] = {
   {L"Flags", 4, 40, L"0x%x", NULL, NULL, NULL, NULL}
 };
 
-/**
-  An ACPI_PARSER array describing the MADT Interrupt Controller Structure Header Structure.
-**/
-STATIC CONST ACPI_PARSER MadtInterruptControllerHeaderParser[] = {
-  {NULL, 1, 0, NULL, NULL, (VOID**)&MadtInterruptControllerType, NULL, NULL},
-  {L"Length", 1, 1, NULL, NULL, (VOID**)&MadtInterruptControllerLength, NULL,
-   NULL},
-  {L"Reserved", 2, 2, NULL, NULL, NULL, NULL, NULL}
-};
-
 /**
   This function validates the System Vector Base in the GICD.
 
@@ -159,13 +178,142 @@ ValidateGICDSystemVectorBase (
 )
 {
   if (*(UINT32*)Ptr != 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: System Vector Base must be zero."
     );
   }
 }
 
+/**
+  This function traces the GICC Interrupt Controller Structure with
+  straight line code.
+
+  GICC structures dominate the MADT on high core count systems, so the
+  hot path avoids the generic ACPI_PARSER interpretation and loads each
+  field directly at its fixed offset. The output is identical to a
+  table driven parse of GicCParser. Structures shorter than the ACPI
+  6.2 definition fall back to the table driven parser, which bounds the
+  field walk against the structure length.
+
+  @param [in] Ptr     Pointer to the start of the structure.
+  @param [in] Length  Length of the structure.
+**/
+STATIC
+VOID
+DumpGicC (
+  IN UINT8*  Ptr,
+  IN UINT32  Length
+  )
+{
+  BOOLEAN HighLight;
+  UINTN   OriginalAttribute;
+  UINTN   Pos;
+  CHAR16  Buffer[1152];
+
+  if (Length < sizeof (EFI_ACPI_6_2_GIC_STRUCTURE)) {
+    ParseAcpi (
+      TRUE,
+      2,
+      "GICC",
+      Ptr,
+      4,
+      PARSER_PARAMS (MadtStructureHeaderParser)
+      );
+    ParseAcpi (
+      TRUE,
+      2,
+      NULL,
+      Ptr + 4,
+      Length - 4,
+      PARSER_PARAMS (GicCParser)
+      );
+    return;
+  }
+
+  HighLight = GetColourHighlighting ();
+  OriginalAttribute = 0;
+
+  if (HighLight) {
+    OriginalAttribute = gST->ConOut->Mode->Attribute;
+    gST->ConOut->SetAttribute (
+                   gST->ConOut,
+                   EFI_TEXT_ATTR(EFI_YELLOW,
+                     ((OriginalAttribute&(BIT4|BIT5|BIT6))>>4))
+                   );
+  }
+  Print (L"  %-*a :\n", OUTPUT_FIELD_COLUMN_WIDTH - 2, "GICC");
+  if (HighLight) {
+    gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
+  }
+
+  // Format all fields into one buffer and flush it with a single Print
+  // call; per field Print calls each cost a console protocol round
+  // trip, which dominates the cost of tracing large MADT tables.
+  Pos = 0;
+  Pos += UnicodeSPrint (
+           &Buffer[Pos],
+           sizeof (Buffer) - (Pos * sizeof (CHAR16)),
+           L"    %-32s : 0x%x\n    %-32s : %d\n    %-32s : 0x%x\n",
+           L"Type",
+           Ptr[0],
+           L"Length",
+           Ptr[1],
+           L"Reserved",
+           *(UINT16*)(Ptr + 2)
+           );
+  Pos += UnicodeSPrint (
+           &Buffer[Pos],
+           sizeof (Buffer) - (Pos * sizeof (CHAR16)),
+           L"    %-32s : 0x%x\n    %-32s : 0x%x\n    %-32s : 0x%x\n"
+             L"    %-32s : 0x%x\n    %-32s : 0x%x\n",
+           L"CPU Interface Number",
+           *(UINT32*)(Ptr + 4),
+           L"ACPI Processor UID",
+           *(UINT32*)(Ptr + 8),
+           L"Flags",
+           *(UINT32*)(Ptr + 12),
+           L"Parking Protocol Version",
+           *(UINT32*)(Ptr + 16),
+           L"Performance Interrupt GSIV",
+           *(UINT32*)(Ptr + 20)
+           );
+  Pos += UnicodeSPrint (
+           &Buffer[Pos],
+           sizeof (Buffer) - (Pos * sizeof (CHAR16)),
+           L"    %-32s : 0x%lx\n    %-32s : 0x%lx\n    %-32s : 0x%lx\n"
+             L"    %-32s : 0x%lx\n",
+           L"Parked Address",
+           ReadUnaligned64 ((CONST UINT64*)(Ptr + 24)),
+           L"Physical Base Address",
+           ReadUnaligned64 ((CONST UINT64*)(Ptr + 32)),
+           L"GICV",
+           ReadUnaligned64 ((CONST UINT64*)(Ptr + 40)),
+           L"GICH",
+           ReadUnaligned64 ((CONST UINT64*)(Ptr + 48))
+           );
+  Pos += UnicodeSPrint (
+           &Buffer[Pos],
+           sizeof (Buffer) - (Pos * sizeof (CHAR16)),
+           L"    %-32s : 0x%x\n    %-32s : 0x%lx\n    %-32s : 0x%lx\n"
+             L"    %-32s : 0x%x\n    %-32s : %x %x %x\n",
+           L"VGIC Maintenance interrupt",
+           *(UINT32*)(Ptr + 56),
+           L"GICR Base Address",
+           ReadUnaligned64 ((CONST UINT64*)(Ptr + 60)),
+           L"MPIDR",
+           ReadUnaligned64 ((CONST UINT64*)(Ptr + 68)),
+           L"Processor Power Efficiency Class",
+           Ptr[76],
+           L"Reserved",
+           Ptr[77],
+           Ptr[78],
+           Ptr[79]
+           );
+
+  Print (L"%s", Buffer);
+}
+
 /**
   This function parses the ACPI MADT table.
   When trace is enabled this function parses the MADT table and
@@ -197,9 +345,12 @@ ParseAcpiMadt (
 {
   UINT32 Offset;
   UINT8* InterruptContollerPtr;
-  UINT32 GICDCount;
+  UINT8  ControllerType;
+  UINT8  ControllerLength;
+  UINT32 CountByType[MAX_UINT8 + 1];
+  CONST MADT_CONTROLLER_INFO* ControllerInfo;
 
-  GICDCount = 0;
+  ZeroMem (CountByType, sizeof (CountByType));
 
   if (!Trace) {
     return;
@@ -216,109 +367,82 @@ ParseAcpiMadt (
   InterruptContollerPtr = Ptr + Offset;
 
   while (Offset < AcpiTableLength) {
-    // Parse Interrupt Controller Structure to obtain Length.
-    ParseAcpi (
-      FALSE,
-      0,
-      NULL,
-      InterruptContollerPtr,
-      2,  //  Length is 1 byte at offset 1
-      PARSER_PARAMS (MadtInterruptControllerHeaderParser)
-      );
-
-    if (((Offset + (*MadtInterruptControllerLength)) > AcpiTableLength) ||
-        (*MadtInterruptControllerLength < 4)) {
-      IncrementErrorCount ();
+    ASSERT (Offset <= AcpiTableLength);
+
+    // The structure header layout is fixed: Type and Length are single
+    // byte fields at offsets 0 and 1, so they are loaded directly
+    // instead of taking a non-tracing ParseAcpi pass per structure.
+    ControllerType = InterruptContollerPtr[0];
+    ControllerLength = InterruptContollerPtr[1];
+
+    // The subtraction cannot wrap as Offset <= AcpiTableLength is a
+    // loop invariant; the previous form (Offset + Length) could in
+    // principle overflow on a crafted table.
+    if ((ControllerLength < 4) ||
+        (ControllerLength > (AcpiTableLength - Offset))) {
+      mTableErrorCount++;
       Print (
          L"ERROR: Invalid Interrupt Controller Length,"
           L" Type = %d, Length = %d\n",
-         *MadtInterruptControllerType,
-         *MadtInterruptControllerLength
+         ControllerType,
+         ControllerLength
          );
       break;
     }
 
-    switch (*MadtInterruptControllerType) {
-      case EFI_ACPI_6_2_GIC: {
-        ParseAcpi (
-          TRUE,
-          2,
-          "GICC",
-          InterruptContollerPtr,
-          *MadtInterruptControllerLength,
-          PARSER_PARAMS (GicCParser)
-          );
-        break;
-      }
-
-      case EFI_ACPI_6_2_GICD: {
-        if (++GICDCount > 1) {
-          IncrementErrorCount ();
-          Print (
-            L"ERROR: Only one GICD must be present,"
-              L" GICDCount = %d\n",
-            GICDCount
-            );
-        }
-        ParseAcpi (
-          TRUE,
-          2,
-          "GICD",
-          InterruptContollerPtr,
-          *MadtInterruptControllerLength,
-          PARSER_PARAMS (GicDParser)
-          );
-        break;
-      }
-
-      case EFI_ACPI_6_2_GIC_MSI_FRAME: {
-        ParseAcpi (
-          TRUE,
-          2,
-          "GIC MSI Frame",
-          InterruptContollerPtr,
-          *MadtInterruptControllerLength,
-          PARSER_PARAMS (GicMSIFrameParser)
-          );
-        break;
-      }
-
-      case EFI_ACPI_6_2_GICR: {
-        ParseAcpi (
-          TRUE,
-          2,
-          "GICR",
-          InterruptContollerPtr,
-          *MadtInterruptControllerLength,
-          PARSER_PARAMS (GicRParser)
-          );
-        break;
-      }
-
-      case EFI_ACPI_6_2_GIC_ITS: {
-        ParseAcpi (
-          TRUE,
-          2,
-          "GIC ITS",
-          InterruptContollerPtr,
-          *MadtInterruptControllerLength,
-          PARSER_PARAMS (GicITSParser)
-          );
-        break;
-      }
-
-      default: {
-        IncrementErrorCount ();
-        Print (
-          L"ERROR: Unknown Interrupt Controller Structure,"
-            L" Type = %d, Length = %d\n",
-          *MadtInterruptControllerType,
-          *MadtInterruptControllerLength
-          );
-      }
-    } // switch
-
-    InterruptContollerPtr += *MadtInterruptControllerLength;
-    Offset += *MadtInterruptControllerLength;
+    // Count every structure type without branching; the per type
+    // limits are validated once after the parse loop.
+    CountByType[ControllerType]++;
+
+    // Dispatch directly on the structure type instead of testing each
+    // known type in turn; MADT tables on large systems can contain
+    // hundreds of GICC entries. The GICC check comes first so that the
+    // dominant structure type takes the specialised path immediately.
+    if (ControllerType == EFI_ACPI_6_2_GIC) {
+      DumpGicC (InterruptContollerPtr, ControllerLength);
+    } else if ((ControllerType < EFI_ACPI_6_2_GIC) ||
+        (ControllerType > EFI_ACPI_6_2_GIC_ITS)) {
+      mTableErrorCount++;
+      Print (
+        L"ERROR: Unknown Interrupt Controller Structure,"
+          L" Type = %d, Length = %d\n",
+        ControllerType,
+        ControllerLength
+        );
+    } else {
+      // Trace the shared Type/Length/Reserved header first, then the
+      // per type structure body; the body parsers carry offsets
+      // rebased to the end of the common header.
+      ControllerInfo = &MadtControllerInfo[ControllerType - EFI_ACPI_6_2_GIC];
+      ParseAcpi (
+        TRUE,
+        2,
+        ControllerInfo->Name,
+        InterruptContollerPtr,
+        4,
+        PARSER_PARAMS (MadtStructureHeaderParser)
+        );
+      ParseAcpi (
+        TRUE,
+        2,
+        NULL,
+        InterruptContollerPtr + 4,
+        ControllerLength - 4,
+        ControllerInfo->Parser,
+        ControllerInfo->Elements
+        );
+    }
+
+    InterruptContollerPtr += ControllerLength;
+    Offset += ControllerLength;
   } // while
+
+  if (CountByType[EFI_ACPI_6_2_GICD] > 1) {
+    mTableErrorCount++;
+    Print (
+      L"ERROR: Only one GICD must be present,"
+        L" GICDCount = %d\n",
+      CountByType[EFI_ACPI_6_2_GICD]
+      );
+  }
 }
@@ -93,7 +93,7 @@ ValidateRsdtAddress (
   RsdtAddr = *(UINT32*)Ptr;
 
   if (RsdtAddr != 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: Rsdt Address = 0x%p. This must be NULL on ARM Platforms.",
       RsdtAddr
@@ -128,7 +128,7 @@ ValidateXsdtAddress (
   XsdtAddr = *(UINT64*)Ptr;
 
   if (XsdtAddr == 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: Xsdt Address = 0x%p. This must not be NULL on ARM Platforms.",
       XsdtAddr
@@ -172,7 +172,7 @@ ParseAcpiRsdp (
   // RSDT to enable compatibility with ACPI 1.0 operating systems.
   // Therefore the RSDT should not be used on ARM platforms.
   if ((*XsdtAddress) == 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (L"ERROR: XSDT Pointer is not set.\n");
     return;
   }
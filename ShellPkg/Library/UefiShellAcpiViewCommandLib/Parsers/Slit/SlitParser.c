@@ -67,7 +67,9 @@ ParseAcpiSlit (
   UINT64 Index;
   UINT64 LocalityCount;
   UINT8* LocalityPtr;
+  UINTN  Pos;
   CHAR16 Buffer[80];  // Used for AsciiName param of ParseAcpi
+  CHAR16 RowBuffer[128];  // Holds one formatted locality matrix row
 
   if (!Trace) {
     return;
@@ -97,17 +99,37 @@ ParseAcpiSlit (
       );
     PrintFieldName (0, Buffer);
     Print (L"\n");
-    Print (L"       ");
+
+    // Batch format each matrix row into a buffer and trace it with a
+    // single Print call; printing each element separately costs a
+    // console protocol round trip per element.
+    Pos = UnicodeSPrint (RowBuffer, sizeof (RowBuffer), L"       ");
     for (Index = 0; Index < LocalityCount; Index++) {
-      Print (L" (%3d) ", Index);
+      Pos += UnicodeSPrint (
+               &RowBuffer[Pos],
+               sizeof (RowBuffer) - (Pos * sizeof (CHAR16)),
+               L" (%3d) ",
+               Index
+               );
     }
-    Print (L"\n");
+    Print (L"%s\n", RowBuffer);
+
     for (Count = 0; Count< LocalityCount; Count++) {
-      Print (L" (%3d) ", Count);
+      Pos = UnicodeSPrint (
+              RowBuffer,
+              sizeof (RowBuffer),
+              L" (%3d) ",
+              Count
+              );
       for (Index = 0; Index < LocalityCount; Index++) {
-        Print (L"  %3d  ", SLIT_ELEMENT (LocalityPtr, Count, Index));
+        Pos += UnicodeSPrint (
+                 &RowBuffer[Pos],
+                 sizeof (RowBuffer) - (Pos * sizeof (CHAR16)),
+                 L"  %3d  ",
+                 SLIT_ELEMENT (LocalityPtr, Count, Index)
+                 );
       }
-      Print (L"\n");
+      Print (L"%s\n", RowBuffer);
     }
   }
 
@@ -116,7 +138,7 @@ ParseAcpiSlit (
     for (Index = 0; Index < LocalityCount; Index++) {
       // Element[x][x] must be equal to 10
       if ((Count == Index) && (SLIT_ELEMENT (LocalityPtr, Count,Index) != 10)) {
-        IncrementErrorCount ();
+        mTableErrorCount++;
         Print (
           L"ERROR: Diagonal Element[0x%lx][0x%lx] (%3d)."
             L" Normalized Value is not 10\n",
@@ -128,7 +150,7 @@ ParseAcpiSlit (
       // Element[i][j] must be equal to Element[j][i]
       if (SLIT_ELEMENT (LocalityPtr, Count, Index) !=
           SLIT_ELEMENT (LocalityPtr, Index, Count)) {
-        IncrementErrorCount ();
+        mTableErrorCount++;
         Print (
           L"ERROR: Relative distances for Element[0x%lx][0x%lx] (%3d) and \n"
            L"Element[0x%lx][0x%lx] (%3d) do not match.\n",
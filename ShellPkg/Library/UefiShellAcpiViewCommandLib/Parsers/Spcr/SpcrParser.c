@@ -104,7 +104,7 @@ ValidateInterruptType (
 
   if (InterruptType !=
         EFI_ACPI_SERIAL_PORT_CONSOLE_REDIRECTION_TABLE_INTERRUPT_TYPE_GIC) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: InterruptType = %d. This must be 8 on ARM Platforms",
       InterruptType
@@ -134,7 +134,7 @@ ValidateIrq (
   Irq = *Ptr;
 
   if (Irq != 0) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (
       L"\nERROR: Irq = %d. This must be zero on ARM Platforms\n",
       Irq
@@ -160,7 +160,7 @@ ValidateSratReserved (
   )
 {
   if (*(UINT32*)Ptr != 1) {
-    IncrementErrorCount ();
+    mTableErrorCount++;
     Print (L"\nERROR: Reserved should be 1 for backward compatibility.\n");
   }
 }
@@ -339,7 +339,7 @@ ParseAcpiSrat (
         break;
 
       default:
-        IncrementErrorCount ();
+        mTableErrorCount++;
         Print (L"ERROR: Unknown SRAT Affinity type = 0x%x\n", *SratRAType);
         break;
     }
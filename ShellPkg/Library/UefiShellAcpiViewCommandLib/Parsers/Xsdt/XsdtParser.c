@@ -131,7 +131,7 @@ ParseAcpiXsdt (
 
       // Validate the table pointers are not NULL
       if ((UINT64*)(UINTN)(*TablePointer) == NULL) {
-        IncrementErrorCount ();
+        mTableErrorCount++;
         Print (
           L"ERROR: Invalid table entry at 0x%lx, table address is 0x%lx\n",
           TablePointer,